@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <ctime>
+#include <tuple>
 
 using namespace std;
 
@@ -27,6 +28,15 @@ enum GameMode { SINGLE_PLAYER, MULTIPLAYER };
 enum Difficulty { EASY, MEDIUM, HARD, IMPOSSIBLE };
 enum BoardType { CLASSIC_2D, ADVANCED_3D };
 
+// Evaluation search settings
+const int EVAL_WIN_SCORE = 100000;
+const int HARD_SEARCH_DEPTH_2D = 2;
+const int HARD_SEARCH_DEPTH_3D = 3;
+const int IMPOSSIBLE_SEARCH_DEPTH_3D = 4;
+const int EVAL_TUNING_DEPTH = 2;
+const int EVAL_TUNING_ROUNDS = 40;
+const int EVAL_TUNING_GAMES = 4;
+
 class GitTacGame {
 private:
     vector<vector<char>> board2D;
@@ -43,6 +53,20 @@ private:
     string player1Name;
     string player2Name;
 
+    // Pattern-table evaluation (Hard AI and 3D search)
+    // Cells are flattened as (layer * size + row) * size + col
+    vector<vector<int>> winLines;      // cells of every winning line
+    vector<vector<int>> cellLines;     // winning lines through each cell
+    vector<int> cellOrder;             // cells sorted by line count (search order)
+    vector<char> evalCells;
+    vector<int> lineCountMine;         // searchPlayer pieces per line
+    vector<int> lineCountTheirs;       // opponent pieces per line
+    vector<vector<int>> patternTable;  // [mine][theirs] -> line score
+    vector<int> evalWeights;           // score of an open line holding k pieces
+    char searchPlayer;
+    int evalScore;
+    int emptyCells;
+
 public:
     GitTacGame() {
         srand(time(0));
@@ -118,6 +142,12 @@ public:
         }
 
         initializeBoard();
+
+        if (mode == SINGLE_PLAYER &&
+            (difficulty == HARD || (difficulty == IMPOSSIBLE && boardType == ADVANCED_3D))) {
+            cout << YELLOW << "\nTuning AI from self-play...\n" << RESET;
+            tuneEvalWeights(EVAL_TUNING_ROUNDS, EVAL_TUNING_GAMES);
+        }
     }
 
     void initializeBoard() {
@@ -129,6 +159,71 @@ public:
                 vector<vector<char>>(boardSize, vector<char>(boardSize, ' '))
             );
         }
+        buildLineTables();
+    }
+
+    void buildLineTables() {
+        // Directions as (layer, row, col) steps, matching checkWin2D/checkWin3D
+        vector<tuple<int, int, int>> directions = {
+            make_tuple(0, 0, 1), make_tuple(0, 1, 0), make_tuple(0, 1, 1), make_tuple(0, 1, -1)
+        };
+        if (boardType == ADVANCED_3D) {
+            directions.push_back(make_tuple(1, 0, 0));
+            directions.push_back(make_tuple(1, 1, 1));
+            directions.push_back(make_tuple(1, 1, -1));
+            directions.push_back(make_tuple(1, -1, 1));
+            directions.push_back(make_tuple(1, -1, -1));
+        }
+
+        int layers = (boardType == CLASSIC_2D) ? 1 : boardSize;
+        int cellCount = layers * boardSize * boardSize;
+        auto inside = [&](int l, int r, int c) {
+            return l >= 0 && l < layers && r >= 0 && r < boardSize && c >= 0 && c < boardSize;
+        };
+
+        winLines.clear();
+        cellLines.assign(cellCount, vector<int>());
+        for (auto dir : directions) {
+            int dl = get<0>(dir), dr = get<1>(dir), dc = get<2>(dir);
+            for (int l = 0; l < layers; l++) {
+                for (int r = 0; r < boardSize; r++) {
+                    for (int c = 0; c < boardSize; c++) {
+                        // A line starts where stepping back leaves the board
+                        int endL = l + dl * (boardSize - 1);
+                        int endR = r + dr * (boardSize - 1);
+                        int endC = c + dc * (boardSize - 1);
+                        if (inside(l - dl, r - dr, c - dc) || !inside(endL, endR, endC)) {
+                            continue;
+                        }
+
+                        vector<int> line;
+                        for (int k = 0; k < boardSize; k++) {
+                            int cell = ((l + dl * k) * boardSize + (r + dr * k)) * boardSize + (c + dc * k);
+                            line.push_back(cell);
+                            cellLines[cell].push_back(winLines.size());
+                        }
+                        winLines.push_back(line);
+                    }
+                }
+            }
+        }
+
+        cellOrder.clear();
+        for (int cell = 0; cell < cellCount; cell++) {
+            cellOrder.push_back(cell);
+        }
+        stable_sort(cellOrder.begin(), cellOrder.end(), [&](int a, int b) {
+            return cellLines[a].size() > cellLines[b].size();
+        });
+
+        evalCells.assign(cellCount, ' ');
+        if ((int)evalWeights.size() != boardSize) {
+            // Hand-set starting point; tuneEvalWeights refines it from self-play
+            evalWeights.assign(boardSize, 0);
+            for (int k = 1; k < boardSize; k++) {
+                evalWeights[k] = (k == boardSize - 1) ? 10 : k;
+            }
+        }
     }
 
     void displayBoard2D() {
@@ -458,33 +553,179 @@ public:
     }
 
     void getAIMoveHard() {
-        if (!tryWinningMove()) {
-            if (!tryBlockingMove()) {
-                if (!tryCornerOrCenter()) {
-                    getAIMoveEasy();
-                }
+        playEvalMove((boardType == CLASSIC_2D) ? HARD_SEARCH_DEPTH_2D : HARD_SEARCH_DEPTH_3D);
+    }
+
+    // Loads the current board into the evaluation state, scored for player
+    void beginSearch(char player, const vector<int>& weights) {
+        searchPlayer = player;
+
+        patternTable.assign(boardSize + 1, vector<int>(boardSize + 1, 0));
+        for (int k = 1; k < boardSize; k++) {
+            patternTable[k][0] = weights[k];
+            patternTable[0][k] = -weights[k];
+        }
+
+        vector<char> cells = evalCells;
+        evalCells.assign(cells.size(), ' ');
+        lineCountMine.assign(winLines.size(), 0);
+        lineCountTheirs.assign(winLines.size(), 0);
+        evalScore = 0;
+        emptyCells = cells.size();
+        for (int cell = 0; cell < (int)cells.size(); cell++) {
+            if (cells[cell] != ' ') {
+                placePiece(cell, cells[cell]);
             }
         }
     }
 
-    bool tryCornerOrCenter() {
-        if (boardType == CLASSIC_2D) {
-            // Try center
-            if (board2D[1][1] == ' ') {
-                makeMove(1, 1);
-                return true;
+    void syncEvalCells() {
+        for (int cell = 0; cell < (int)evalCells.size(); cell++) {
+            int layer = cell / (boardSize * boardSize);
+            int row = (cell / boardSize) % boardSize;
+            int col = cell % boardSize;
+            evalCells[cell] = (boardType == CLASSIC_2D) ? board2D[row][col] : board3D[layer][row][col];
+        }
+    }
+
+    // Updates the line patterns touched by cell; returns true if player completed a line
+    bool placePiece(int cell, char player) {
+        bool mine = (player == searchPlayer);
+        bool won = false;
+        for (int line : cellLines[cell]) {
+            evalScore -= patternTable[lineCountMine[line]][lineCountTheirs[line]];
+            int count = mine ? ++lineCountMine[line] : ++lineCountTheirs[line];
+            evalScore += patternTable[lineCountMine[line]][lineCountTheirs[line]];
+            if (count == boardSize) won = true;
+        }
+        evalCells[cell] = player;
+        emptyCells--;
+        return won;
+    }
+
+    void removePiece(int cell) {
+        bool mine = (evalCells[cell] == searchPlayer);
+        for (int line : cellLines[cell]) {
+            evalScore -= patternTable[lineCountMine[line]][lineCountTheirs[line]];
+            if (mine) {
+                lineCountMine[line]--;
+            } else {
+                lineCountTheirs[line]--;
             }
-            
-            // Try corners
-            vector<pair<int, int>> corners = {{0,0}, {0,2}, {2,0}, {2,2}};
-            for (auto corner : corners) {
-                if (board2D[corner.first][corner.second] == ' ') {
-                    makeMove(corner.first, corner.second);
-                    return true;
+            evalScore += patternTable[lineCountMine[line]][lineCountTheirs[line]];
+        }
+        evalCells[cell] = ' ';
+        emptyCells++;
+    }
+
+    // Depth-limited minimax with alpha-beta pruning, scored by the pattern table
+    int searchPosition(int depth, bool isMaximizing, int alpha, int beta) {
+        if (depth == 0 || emptyCells == 0) return evalScore;
+
+        char opponent = (searchPlayer == 'X') ? 'O' : 'X';
+        int bestScore = isMaximizing ? -EVAL_WIN_SCORE * 2 : EVAL_WIN_SCORE * 2;
+        for (int cell : cellOrder) {
+            if (evalCells[cell] != ' ') continue;
+
+            int score;
+            if (placePiece(cell, isMaximizing ? searchPlayer : opponent)) {
+                // Prefer faster wins and slower losses
+                score = isMaximizing ? EVAL_WIN_SCORE + depth : -EVAL_WIN_SCORE - depth;
+            } else {
+                score = searchPosition(depth - 1, !isMaximizing, alpha, beta);
+            }
+            removePiece(cell);
+
+            if (isMaximizing) {
+                bestScore = max(score, bestScore);
+                alpha = max(alpha, score);
+            } else {
+                bestScore = min(score, bestScore);
+                beta = min(beta, score);
+            }
+            if (alpha >= beta) break;
+        }
+        return bestScore;
+    }
+
+    // Returns the best cell for searchPlayer, breaking ties randomly
+    int chooseEvalMove(int depth) {
+        int bestScore = -EVAL_WIN_SCORE * 2;
+        vector<int> bestCells;
+        for (int cell : cellOrder) {
+            if (evalCells[cell] != ' ') continue;
+
+            int score;
+            if (placePiece(cell, searchPlayer)) {
+                score = EVAL_WIN_SCORE + depth;
+            } else {
+                score = searchPosition(depth - 1, false, bestScore - 1, EVAL_WIN_SCORE * 2);
+            }
+            removePiece(cell);
+
+            if (score > bestScore) {
+                bestScore = score;
+                bestCells.clear();
+            }
+            if (score == bestScore) {
+                bestCells.push_back(cell);
+            }
+        }
+        return bestCells.empty() ? -1 : bestCells[rand() % bestCells.size()];
+    }
+
+    void playEvalMove(int depth) {
+        syncEvalCells();
+        beginSearch(aiPlayer, evalWeights);
+        int cell = chooseEvalMove(depth);
+        if (cell == -1) return;
+
+        makeMove((cell / boardSize) % boardSize, cell % boardSize, cell / (boardSize * boardSize));
+        cout << GREEN << "AI played at position.\n" << RESET;
+    }
+
+    // Plays one shallow game between two weight sets on the evaluation
+    // board; returns 1 if X wins, -1 if O wins, 0 for a draw
+    int playSelfPlayGame(const vector<int>& weightsX, const vector<int>& weightsO) {
+        evalCells.assign(evalCells.size(), ' ');
+        char player = 'X';
+
+        // Random opening so repeated games explore different lines
+        int cell = rand() % evalCells.size();
+        while (true) {
+            beginSearch(player, (player == 'X') ? weightsX : weightsO);
+            if (cell == -1) cell = chooseEvalMove(EVAL_TUNING_DEPTH);
+            if (placePiece(cell, player)) return (player == 'X') ? 1 : -1;
+            if (emptyCells == 0) return 0;
+
+            player = (player == 'X') ? 'O' : 'X';
+            cell = -1;
+        }
+    }
+
+    // Hill-climbs evalWeights: a perturbed candidate replaces the current
+    // weights only if it outscores them over games played from both sides
+    void tuneEvalWeights(int rounds, int gamesPerRound) {
+        for (int round = 0; round < rounds; round++) {
+            vector<int> candidate = evalWeights;
+            int k = 1 + rand() % (boardSize - 1);
+            int step = max(1, candidate[k] / 4);
+            candidate[k] = max(1, candidate[k] + ((rand() % 2) ? step : -step));
+
+            int candidateScore = 0;
+            for (int game = 0; game < gamesPerRound; game++) {
+                if (game % 2 == 0) {
+                    candidateScore += playSelfPlayGame(candidate, evalWeights);
+                } else {
+                    candidateScore -= playSelfPlayGame(evalWeights, candidate);
                 }
             }
+
+            if (candidateScore > 0) {
+                evalWeights = candidate;
+            }
         }
-        return false;
+        evalCells.assign(evalCells.size(), ' ');
     }
 
     int minimax(int depth, bool isMaximizing) {
@@ -532,7 +773,8 @@ public:
 
     void getAIMoveImpossible() {
         if (boardType == ADVANCED_3D) {
-            getAIMoveHard();
+            // Full minimax is too slow on the cube; search deeper than Hard instead
+            playEvalMove(IMPOSSIBLE_SEARCH_DEPTH_3D);
             return;
         }
 